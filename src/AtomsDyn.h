@@ -50,10 +50,13 @@ class AtomsDyn : public Var
             v == "SDA" ||
             v == "CG" ||
             v == "MD" ||
-            v == "BMD" ) )
+            v == "BMD" ||
+            v == "LBFGS" ||
+            v == "FIRE" ) )
     {
       if ( ui->onpe0() )
-        cout << " atoms_dyn must be LOCKED, SD, SDA, CG, MD or BMD" << endl;
+        cout << " atoms_dyn must be LOCKED, SD, SDA, CG, MD, BMD, LBFGS"
+             << " or FIRE" << endl;
       return 1;
     }
 
@@ -51,5 +51,7 @@ class BLYPFunctional : public XCFunctional
   bool isGGA() const { return true; };
   std::string name() const { return "BLYP"; };
   void setxc(void);
+  bool batched(void) const { return true; }
+  void setxc_batch(int first, int n);
 };
 #endif
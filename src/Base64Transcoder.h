@@ -31,22 +31,36 @@ class Base64Transcoder
   char etable[64];  // encode table
   byte dtable[256]; // decode table
 
+  void encode_block(size_t nbytes, const byte* const from,
+                    char* const to) const;
+  size_t decode_groups(size_t ngroups, const char* const from,
+                       byte* const to, bool swap, bool& stop) const;
+  size_t decode_(size_t nchars, const char* const from, byte* const to,
+                 bool swap) const;
+
   public:
 
   Base64Transcoder();
-  int encode(int nbytes, const byte* const from, char* const to);
-  int decode(int nchars, const char* const from, byte* const to);
+  size_t encode(size_t nbytes, const byte* const from, char* const to);
+  size_t decode(size_t nchars, const char* const from, byte* const to);
+  // encode n doubles, optionally byte swapping them on the fly
+  size_t encode_double(size_t n, const double* const x, char* const to,
+                       bool swap);
+  // decode into doubles, optionally byte swapping them on the fly
+  // the number of bytes decoded is returned
+  size_t decode_double(size_t nchars, const char* const from,
+                       double* const x, bool swap);
   void byteswap_double(size_t n, double* const x);
   void byteswap_int(size_t n, int* const x);
-  int print(int nchars, const char* const buf, std::ostream& o);
+  int print(size_t nchars, const char* const buf, std::ostream& o);
   int print(const std::string buf, std::ostream& o);
-  int print(int nchars, const char* const buf, FILE* outfile);
+  int print(size_t nchars, const char* const buf, FILE* outfile);
   int print(const std::string buf, FILE* outfile);
 
   // number of chars needed to encode nbytes bytes
-  int nchars(int nbytes) { return 4 * ( ( nbytes + 2 ) / 3 ); }
+  size_t nchars(size_t nbytes) { return 4 * ( ( nbytes + 2 ) / 3 ); }
   // number of bytes needed to decode nchars chars
-  int nbytes(int nchars) { return 3 * ( nchars / 4 ); }
+  size_t nbytes(size_t nchars) { return 3 * ( nchars / 4 ); }
 };
 
 #endif
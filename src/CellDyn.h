@@ -46,10 +46,11 @@ class CellDyn : public Var
     }
 
     string v = argv[1];
-    if ( !( v == "LOCKED" || v == "SD" || v == "CG" ) )
+    if ( !( v == "LOCKED" || v == "SD" || v == "CG" ||
+            v == "LBFGS" || v == "FIRE" ) )
     {
       if ( ui->onpe0() )
-        cout << " cell_dyn must be LOCKED, SD or CG" << endl;
+        cout << " cell_dyn must be LOCKED, SD, CG, LBFGS or FIRE" << endl;
       return 1;
     }
 
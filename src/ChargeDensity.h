@@ -30,6 +30,8 @@
 class Wavefunction;
 class FourierTransform;
 class Basis;
+class DualBasisMapping;
+class SymmetrySet;
 
 typedef std::map<std::string,Timer> TimerMap;
 
@@ -44,6 +46,23 @@ class ChargeDensity
   FourierTransform* vft_;
   std::vector<FourierTransform*> ft_; // ft_[ikp];
   std::valarray<std::complex<double> > rhotmp;
+
+  // coarse wavefunction grid: densities are computed on the grid of cft_
+  // and interpolated to vbasis_ in reciprocal space.
+  // This is an approximation. The density has components up to 2*G_wf
+  // (G_wf: radius of the wavefunction sphere) but the coarse grid only
+  // holds components up to about G_wf: products of wavefunctions are
+  // aliased and the density is truncated to the sphere G_wf (cbasis_).
+  // The local potential applied to the wavefunctions is filtered to the
+  // same sphere. A sphere of radius 2*G_wf requires the fine grid.
+  // The errors in the energy and forces grow with the weight of the
+  // density beyond G_wf, see test/si2coarse for a soft pseudopotential
+  bool coarse_grid_;
+  Basis* cbasis_;
+  FourierTransform* cft_;
+  DualBasisMapping* cmap_;
+  std::vector<double> rhorc;
+  std::valarray<std::complex<double> > rhotmpc, rhogc;
   // YY
   std::valarray<std::complex<double> > tautmp;
   // YY
@@ -62,6 +81,8 @@ class ChargeDensity
 
   // core density ptr. If non-zero, contains the real-space core density
   double* rhocore_r;
+  // symmetry operations ptr. If non-zero, rhog and taug are symmetrized
+  SymmetrySet* symmetries;
   void update_density(void);
   void update_rhor(void);
 
@@ -76,7 +97,15 @@ class ChargeDensity
   FourierTransform* vft(void) const { return vft_; }
   FourierTransform* ft(int ikp) const { return ft_[ikp]; }
 
-  ChargeDensity(const Wavefunction& wf);
+  bool coarse_grid(void) const { return coarse_grid_; }
+  Basis* cbasis(void) const { return cbasis_; }
+  FourierTransform* cft(void) const { return cft_; }
+  // filter a function on the vft_ grid to the wavefunction grid cft_
+  void filter_to_wf_grid(const double* v, double* vc);
+
+  // pencil: use the pencil decomposition of FourierTransform on all grids
+  ChargeDensity(const Wavefunction& wf, bool coarse_grid = false,
+                bool pencil = false);
   ~ChargeDensity();
 };
 #endif
@@ -147,7 +147,7 @@ class Context
   // returns -1 if current process is not part of this context
   int myproc() const;
   int mype() const;
-  // process id of process (irow,icol)
+  // rank in the parent communicator of process (irow,icol)
   int pmap(int irow, int icol) const;
 
   bool onpe0(void) const;
@@ -28,6 +28,7 @@ struct Control
   // control variables
   std::string debug, timing;
   std::string wf_dyn, atoms_dyn; // dynamics string flags
+  std::string lbfgs_hessian; // initial inverse Hessian of L-BFGS relaxation
   int nite;
   double emass;       // electron mass
 
@@ -35,6 +36,8 @@ struct Control
   double ecutprec;
 
   std::string wf_diag;
+  std::string wf_grid; // FINE: density grid, COARSE: wf grid, approximate
+  std::string fft_decomp; // SLAB or PENCIL decomposition of real-space grids
 
   std::string tcp;
   double tcp_rcut;
@@ -58,6 +61,8 @@ struct Control
   int delta_spin;
 
   double dt;
+  int mts_nstep; // inner steps of multiple time step hybrid MD
+  int xlbomd;    // dissipation order of XL-BOMD, 0: off
   int iprint;
   int timeout;
 
@@ -67,6 +72,7 @@ struct Control
 
   int blHF[3];
   double btHF;
+  int qmeshHF[3]; // q-point mesh of the exchange operator, 0: all kpoints
 
   double scf_tol;
 
@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// DualBasisMapping.h
+//
+// Mapping of Fourier coefficients between a basis and a larger basis
+// defined on the same cell, k-point and communicator. The G vectors of
+// the small basis must be a subset of those of the large basis.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef DUALBASISMAPPING_H
+#define DUALBASISMAPPING_H
+
+#include <complex>
+#include <vector>
+
+class Basis;
+
+class DualBasisMapping
+{
+  private:
+
+  const Basis& cbasis_; // small basis
+  const Basis& fbasis_; // large basis
+  int nprocs_, myproc_;
+
+  // counts and displacements in units of sizeof(double)
+  std::vector<int> scounts, sdispl, rcounts, rdispl;
+  std::vector<std::complex<double> > sbuf, rbuf;
+
+  // isend_[i]: local index in cbasis_ of element i of sbuf
+  // irecv_[i]: local index in fbasis_ of element i of rbuf
+  std::vector<int> isend_, irecv_;
+
+  public:
+
+  DualBasisMapping(const Basis& cbasis, const Basis& fbasis);
+
+  // f(G) = c(G) for G in cbasis, f(G) = 0 otherwise
+  void expand(const std::complex<double>* c, std::complex<double>* f);
+  // c(G) = f(G) for G in cbasis
+  void truncate(const std::complex<double>* f, std::complex<double>* c);
+};
+#endif
@@ -75,10 +75,14 @@ class EnergyFunctional
     sigma_enl, sigma_esr, sigma;
 
   bool core_charge_;
+  // number of calls to update_vhxc
+  int nupdate_vhxc_;
 
   public:
 
   std::vector<std::vector<double> > v_r;
+  // local potential on the wavefunction grid if cd_.coarse_grid()
+  std::vector<std::vector<double> > vc_r;
   mutable TimerMap tmap;
 
   double energy(bool compute_hpsi, Wavefunction& dwf,
@@ -110,8 +114,15 @@ class EnergyFunctional
   const ConfinementPotential *confpot(int ikp) const { return cfp[ikp]; }
 
   void update_vhxc(bool compute_stress);
+  // changes when the Hamiltonian is modified by update_vhxc
+  int nupdate_vhxc(void) const { return nupdate_vhxc_; }
+
+  // use the semilocal functional underlying a hybrid functional
+  bool has_semilocal_xc(void) const;
+  void set_semilocal_xc(bool b);
 
   void atoms_moved(void);
+  double compute_esr(void);
   void cell_moved(void);
 
   void print(std::ostream& os) const;
@@ -35,6 +35,8 @@ class ExchangeOperator
   double rcut_;
   // mixing coefficient for exchange energy and dwf accumulation
   double HFCoeff_;
+  // screening parameter of the erfc-screened kernel (0: bare Coulomb)
+  double mu_;
 
   // HF stress tensor
   std::valarray<double> sigma_exhf_;
@@ -65,6 +67,16 @@ class ExchangeOperator
   FourierTransform*  wft_;
   FourierTransform* dwft_;
 
+  // Fourier transforms for states and forces at each kpoint
+  vector<FourierTransform*> wftk_;
+
+  // q-point mesh: use_q1_[i][j] (resp. use_q2_) is non-zero if the pair
+  // (ki,kj) (resp. (ki,-kj)) is included, qfac_[i] normalizes the weights
+  vector<vector<int> > use_q1_;
+  vector<vector<int> > use_q2_;
+  vector<double> qfac_;
+  void setup_qmesh_(void);
+
   // pair densities
   vector<complex<double> > rhog1_;
   vector<complex<double> > rhog2_;
@@ -176,7 +188,7 @@ class ExchangeOperator
   public:
 
   // constructor
-  ExchangeOperator(Sample& s_, double HFCoeff);
+  ExchangeOperator(Sample& s_, double HFCoeff, double mu = 0.0);
 
   // destructor
   ~ExchangeOperator();
@@ -184,6 +196,7 @@ class ExchangeOperator
   // parameters
   void setmixCoeff(double value) { HFCoeff_ = value; };
   double HFCoeff() { return HFCoeff_; };
+  double mu() { return mu_; };
 
   // exchange energy and forces computation
   double eex() { return eex_; };
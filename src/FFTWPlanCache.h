@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// FFTWPlanCache.h
+//
+// Process-wide registry of in-place FFTW3 plans, keyed by the transform
+// dimensions, strides, direction and number of threads. Plans are created
+// on first request, shared by all FourierTransform objects and kept until
+// the end of the run. FFTW wisdom can be imported from and exported to a
+// file so that measured plans are reused across runs.
+// Without USE_FFTW3, only the wisdom file name is recorded.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FFTWPLANCACHE_H
+#define FFTWPLANCACHE_H
+
+#include <complex>
+#include <vector>
+#include <map>
+#include <string>
+
+#if USE_FFTW3
+#include "fftw3.h"
+#endif
+
+#if USE_MPI
+#include <mpi.h>
+#else
+typedef int MPI_Comm;
+#endif
+
+class FFTWPlanCache
+{
+  private:
+
+  std::string wisdom_file_;
+  int nhits_, nmiss_;
+#if USE_FFTW3
+  std::map<std::vector<int>,fftw_plan> plans_;
+#endif
+
+  FFTWPlanCache(void) : nhits_(0), nmiss_(0) {}
+  FFTWPlanCache(const FFTWPlanCache&);
+  FFTWPlanCache& operator=(const FFTWPlanCache&);
+  ~FFTWPlanCache(void);
+
+  public:
+
+  static FFTWPlanCache& instance(void);
+
+#if USE_FFTW3
+  // in-place plan for transforms of rank rank repeated over howmany_rank
+  // dimensions (see fftw_plan_guru_dft). p is only used for planning.
+  fftw_plan plan(int rank, const fftw_iodim* dims,
+    int howmany_rank, const fftw_iodim* howmany_dims,
+    std::complex<double>* p, int sign);
+  // contiguous 1D transform of length n
+  fftw_plan plan_1d(int n, std::complex<double>* p, int sign);
+#endif
+
+  int size(void) const;
+  int nhits(void) const { return nhits_; }
+  int nmiss(void) const { return nmiss_; }
+
+  // read wisdom on task 0 of comm and broadcast it
+  // returns false if the file could not be read
+  bool import_wisdom(const std::string& filename, MPI_Comm comm);
+  // write accumulated wisdom of task 0 of comm to the wisdom file
+  void export_wisdom(MPI_Comm comm) const;
+  const std::string& wisdom_file(void) const { return wisdom_file_; }
+};
+#endif
@@ -0,0 +1,54 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2011 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// FIRECellStepper.h:
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FIRECELLSTEPPER_H
+#define FIRECELLSTEPPER_H
+
+#include "RelaxCellStepper.h"
+#include "FIREOptimizer.h"
+
+class FIRECellStepper : public RelaxCellStepper
+{
+  private:
+
+  FIREOptimizer fire_;
+
+  void compute_xp(const std::valarray<double>& x, double e,
+    std::valarray<double>& g, std::valarray<double>& xp)
+  {
+    fire_.compute_xp(x,e,g,xp);
+    if ( s_.ctxt_.onpe0() )
+      std::cout << "  FIRECellStepper: dt = " << fire_.dt()
+                << " alpha = " << fire_.alpha() << std::endl;
+  }
+
+  public:
+
+  FIRECellStepper(Sample& s) : RelaxCellStepper(s),
+    fire_(FIREOptimizer(3*s.atoms.size()+9))
+  {
+    fire_.set_dt_start(1.0);
+    fire_.set_dt_max(10.0);
+    fire_.set_max_step(0.2);
+#ifdef DEBUG
+    if ( s.ctxt_.onpe0() )
+      fire_.set_debug_print();
+#endif
+  }
+};
+#endif
@@ -0,0 +1,38 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2011 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// FIREIonicStepper.h:
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FIREIONICSTEPPER_H
+#define FIREIONICSTEPPER_H
+
+#include "IonicStepper.h"
+#include "FIREOptimizer.h"
+
+class FIREIonicStepper : public IonicStepper
+{
+  private:
+
+  FIREOptimizer fire_;
+
+  public:
+
+  FIREIonicStepper(Sample& s);
+  void compute_r(double e0, const std::vector<std::vector< double> >& f0);
+  void compute_v(double e0, const std::vector<std::vector< double> >& f0) {}
+  void reset(void) { fire_.reset(); }
+};
+#endif
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2011 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// FIREOptimizer.h:
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Fast inertial relaxation engine
+// E.Bitzek et al., Phys. Rev. Lett. 97, 170201 (2006)
+// Damped dynamics of unit mass particles with adaptive time step.
+// The step is limited to a maximum displacement of max_step in any component.
+
+#ifndef FIREOPTIMIZER_H
+#define FIREOPTIMIZER_H
+
+#include <valarray>
+
+class FIREOptimizer
+{
+  private:
+
+  int n_, npos_;
+  bool first_step_, debug_print;
+  std::valarray<double> v_;
+  double dt_, dt_start_, dt_max_, alpha_, max_step_;
+
+  public:
+
+  FIREOptimizer(int n): n_(n), npos_(0), first_step_(true),
+    debug_print(false), dt_(1.0), dt_start_(1.0), dt_max_(10.0), alpha_(0.1),
+    max_step_(0.0)
+  {
+    v_.resize(n);
+  }
+
+  void reset(void) { first_step_ = true; }
+  void set_dt_start(double dt) { dt_start_ = dt; }
+  void set_dt_max(double dt) { dt_max_ = dt; }
+  void set_max_step(double d) { max_step_ = d; }
+  void set_debug_print(void) { debug_print = true; }
+
+  int size(void) const { return n_; }
+  double dt(void) const { return dt_; }
+  double dt_start(void) const { return dt_start_; }
+  double dt_max(void) const { return dt_max_; }
+  double alpha(void) const { return alpha_; }
+  double max_step(void) const { return max_step_; }
+  void compute_xp(const std::valarray<double>& x, const double f,
+                  std::valarray<double>& g, std::valarray<double>& xp);
+};
+#endif
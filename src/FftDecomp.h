@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// FftDecomp.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FFTDECOMP_H
+#define FFTDECOMP_H
+
+#include<iostream>
+#include<iomanip>
+#include<sstream>
+#include<stdlib.h>
+
+#include "Sample.h"
+
+class FftDecomp : public Var
+{
+  Sample *s;
+
+  public:
+
+  const char *name ( void ) const { return "fft_decomp"; };
+
+  int set ( int argc, char **argv )
+  {
+    if ( argc != 2 )
+    {
+      if ( ui->onpe0() )
+      cout << " fft_decomp takes only one value" << endl;
+      return 1;
+    }
+
+    string v = argv[1];
+    if ( !( v == "SLAB" || v == "PENCIL" ) )
+    {
+      if ( ui->onpe0() )
+        cout << " fft_decomp must be SLAB or PENCIL" << endl;
+      return 1;
+    }
+
+    s->ctrl.fft_decomp = v;
+
+    return 0;
+  }
+
+  string print (void) const
+  {
+     ostringstream st;
+     st.setf(ios::left,ios::adjustfield);
+     st << setw(10) << name() << " = ";
+     st.setf(ios::right,ios::adjustfield);
+     st << setw(10) << s->ctrl.fft_decomp;
+     return st.str();
+  }
+
+  FftDecomp(Sample *sample) : s(sample) { s->ctrl.fft_decomp = "SLAB"; };
+};
+#endif
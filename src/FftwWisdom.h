@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// FftwWisdom.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef FFTWWISDOM_H
+#define FFTWWISDOM_H
+
+#include<iostream>
+#include<iomanip>
+#include<sstream>
+#include<stdlib.h>
+
+#include "Sample.h"
+#include "FFTWPlanCache.h"
+
+class FftwWisdom : public Var
+{
+  Sample *s;
+
+  public:
+
+  const char *name ( void ) const { return "fftw_wisdom"; };
+
+  int set ( int argc, char **argv )
+  {
+    // use: set fftw_wisdom filename
+    // wisdom is imported from filename if it exists, and exported
+    // to filename at the end of the run
+    if ( argc != 2 )
+    {
+      if ( ui->onpe0() )
+      cout << " use: set fftw_wisdom filename" << endl;
+      return 1;
+    }
+
+    FFTWPlanCache& c = FFTWPlanCache::instance();
+    const bool imported = c.import_wisdom(argv[1],s->ctxt_.comm());
+    if ( ui->onpe0() )
+    {
+      if ( imported )
+        cout << " fftw_wisdom: imported wisdom from " << argv[1] << endl;
+      else
+        cout << " fftw_wisdom: no wisdom imported, wisdom will be saved to "
+             << argv[1] << endl;
+    }
+
+    return 0;
+  }
+
+  string print (void) const
+  {
+     ostringstream st;
+     st.setf(ios::left,ios::adjustfield);
+     st << setw(10) << name() << " = ";
+     st.setf(ios::right,ios::adjustfield);
+     st << setw(10) << FFTWPlanCache::instance().wisdom_file();
+     return st.str();
+  }
+
+  FftwWisdom(Sample *sample) : s(sample) {};
+};
+#endif
@@ -62,9 +62,10 @@ class FourierTransform
   int nprocs_, myproc_;
 
   int np0_,np1_,np2_;
-  int ntrans0_,ntrans1_,ntrans2_;
+  int ntrans0_,ntrans0neg_,ntrans1_,ntrans2_;
 
   int nvec_;
+  double fft_flops_; // estimated local flop count of one transform
 
   std::vector<int> np2_loc_; // np2_loc_[iproc], iproc=0, nprocs_-1
   std::vector<int> np2_first_; // np2_first_[iproc], iproc=0, nprocs_-1
@@ -76,7 +77,24 @@ class FourierTransform
   std::vector<int> ifftp_, ifftm_;
   std::vector<int> ipack_, iunpack_;
 
+  // pencil decomposition: the y and z directions of the real-space grid
+  // are distributed on a nproc1_ x nproc2_ grid of tasks, with
+  // myproc_ = iproc1_ + nproc1_ * iproc2_
+  bool pencil_;
+  int nproc1_, nproc2_, iproc1_, iproc2_;
+  MPI_Comm ycomm_; // tasks with the same iproc2_ (second transpose)
+  std::vector<int> np1_loc_; // np1_loc_[iproc], iproc=0, nprocs_-1
+  std::vector<int> np1_first_; // np1_first_[iproc], iproc=0, nprocs_-1
+  // x indices of non-empty columns, distributed on the nproc1_ tasks
+  std::vector<int> xlist_, nx_loc_, nx_first_;
+  // y lines after the first transpose: ybuf_[y+np1_*(ix_loc+nx_loc*k_loc)]
+  std::vector<std::complex<double> > ybuf_;
+  std::vector<int> scounts2, sdispl2, rcounts2, rdispl2;
+  std::vector<std::complex<double> > sbuf2, rbuf2;
+  std::vector<int> ipack2_, iunpack2_;
+
   void init_lib(void);
+  void init_pencil(void);
 
 #if USE_ESSL_FFT
 #if USE_ESSL_2DFFT
@@ -97,9 +115,14 @@ class FourierTransform
   fftw_plan fwplan, bwplan;
 #if defined(USE_FFTW3_2D) || defined(USE_FFTW3_THREADS)
   fftw_plan fwplan2d, bwplan2d;
+  // pruned xy transforms: x transforms of non-empty lines only
+  bool pruned_;
+  fftw_plan fwplanxp, bwplanxp, fwplanyp, bwplanyp;
 #else
   fftw_plan fwplanx, fwplany, bwplanx, bwplany;
 #endif
+  // contiguous 1D plans along x, y and z for the pencil decomposition
+  fftw_plan fwplanp[3], bwplanp[3];
 #elif defined(FFT_NOLIB)
   // no library
 #else
@@ -113,10 +136,18 @@ class FourierTransform
   void zvec_to_doublevector(std::complex<double>* c1, std::complex<double>* c2);
   void fwd(std::complex<double>* val);
   void bwd(std::complex<double>* val);
+  void fwd_pencil(std::complex<double>* val);
+  void bwd_pencil(std::complex<double>* val);
+  // nlines contiguous transforms along direction idim
+  // isign = 1: backward, isign = -1: forward (not scaled)
+  void fft_lines(int idim, int isign, std::complex<double>* p, int nlines);
 
   public:
 
-  FourierTransform (const Basis &basis, int np0, int np1, int np2);
+  // pencil: distribute the y and z directions of the real-space grid
+  // if the z direction alone does not balance the tasks of basis.comm()
+  FourierTransform (const Basis &basis, int np0, int np1, int np2,
+                    bool pencil = false);
   ~FourierTransform ();
   MPI_Comm comm(void) const { return comm_; }
 
@@ -142,14 +173,27 @@ class FourierTransform
   int np2_loc(int iproc) const { return np2_loc_[iproc]; }
   int np2_first() const { return np2_first_[myproc_]; }
   int np2_first(int iproc) const { return np2_first_[iproc]; }
+  // local y range: np1_loc() == np1() unless pencil() is true
+  bool pencil() const { return pencil_; }
+  int nproc1() const { return nproc1_; }
+  int nproc2() const { return nproc2_; }
+  int np1_loc() const { return np1_loc_[myproc_]; }
+  int np1_loc(int iproc) const { return np1_loc_[iproc]; }
+  int np1_first() const { return np1_first_[myproc_]; }
+  int np1_first(int iproc) const { return np1_first_[iproc]; }
   long int np012() const { return ((long int)np0_) * np1_ * np2_; }
-  int np012loc(int iproc) const { return np0_ * np1_ * np2_loc_[iproc]; }
-  int np012loc() const { return np0_ * np1_ * np2_loc_[myproc_]; }
+  int np012loc(int iproc) const
+  { return np0_ * np1_loc_[iproc] * np2_loc_[iproc]; }
+  int np012loc() const { return np0_ * np1_loc_[myproc_] * np2_loc_[myproc_]; }
+  // index of local grid point (i,j,k), j and k relative to np1_first, np2_first
   int index(int i, int j, int k) const
-  { return i + np0_ * ( j +  np1_ * k ); }
+  { return i + np0_ * ( j +  np1_loc_[myproc_] * k ); }
+  // global grid indices of local point ind
   int i(int ind) const { return ind % np0_; }
-  int j(int ind) const { return (ind / np0_) % np1_; }
-  int k(int ind) const { return (ind / np0_) / np1_ + np2_first(); }
+  int j(int ind) const
+  { return (ind / np0_) % np1_loc_[myproc_] + np1_first_[myproc_]; }
+  int k(int ind) const
+  { return (ind / np0_) / np1_loc_[myproc_] + np2_first(); }
 
   void reset_timers(void);
   Timer tm_f_map, tm_f_fft, tm_f_pack, tm_f_mpi, tm_f_zero, tm_f_unpack,
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// InitWfCmd.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INITWFCMD_H
+#define INITWFCMD_H
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+using namespace std;
+
+#include "UserInterface.h"
+#include "Sample.h"
+
+class SlaterDet;
+
+class InitWfCmd : public Cmd
+{
+  private:
+
+  // number of atomic orbitals
+  int n_atomic_orbitals(void) const;
+  // set the first n_atomic_orbitals() states of sd to atomic orbitals
+  void set_atomic_orbitals(SlaterDet& sd) const;
+  int init_atomic(void);
+
+  public:
+
+  Sample *s;
+
+  InitWfCmd(Sample *sample) : s(sample) {};
+
+  const char *name(void) const { return "init_wf"; }
+  const char *help_msg(void) const
+  {
+    return
+    "\n init_wf\n\n"
+    " syntax: init_wf atomic\n\n"
+    "   The init_wf command initializes the wavefunction.\n"
+    "   init_wf atomic: diagonalize the Hamiltonian in the subspace of the\n"
+    "   pseudo-atomic wavefunctions of the species, using the potential\n"
+    "   of the density of the atomic orbitals.\n\n";
+  }
+
+  int action(int argc, char **argv);
+};
+#endif
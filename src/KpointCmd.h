@@ -40,7 +40,14 @@ class KpointCmd : public Cmd
     " syntax:\n\n"
     "   kpoint add kx ky kz weight\n"
     "   kpoint delete kx ky kz \n"
-    "   kpoint list\n\n";
+    "   kpoint mesh n0 n1 n2 [s0 s1 s2]\n"
+    "   kpoint list\n\n"
+    "   kpoint mesh replaces the kpoint set with the irreducible kpoints\n"
+    "   of a n0 x n1 x n2 Monkhorst-Pack mesh, using the operations\n"
+    "   defined by the symmetry command. s_i = 1 shifts the mesh by half\n"
+    "   a mesh spacing (e.g. Gamma-centered mesh for even n_i).\n"
+    "   With hybrid functionals, symmetry operations must be removed\n"
+    "   (symmetry off) before using kpoint mesh.\n\n";
   }
 
   int action(int argc, char **argv)
@@ -80,6 +87,47 @@ class KpointCmd : public Cmd
       double kz = atof(argv[4]);
       s->wf.del_kpoint(D3vector(kx,ky,kz));
     }
+    else if ( subcmd == "mesh" )
+    {
+      if ( argc != 5 && argc != 8 )
+      {
+        if ( onpe0 )
+          cout << help_msg();
+        return 1;
+      }
+      int n[3], shift[3] = { 0, 0, 0 };
+      for ( int i = 0; i < 3; i++ )
+      {
+        n[i] = atoi(argv[2+i]);
+        if ( argc == 8 )
+          shift[i] = atoi(argv[5+i]);
+        if ( n[i] < 1 || shift[i] < 0 || shift[i] > 1 )
+        {
+          if ( onpe0 )
+            cout << " kpoint mesh: incorrect mesh parameters" << endl;
+          return 1;
+        }
+      }
+      // the exchange operator assumes that each kpoint only represents
+      // k and -k: symmetry reduction is not used with hybrid functionals
+      const string& xc = s->ctrl.xc;
+      const bool hybrid = xc == "HF" || xc == "PBE0" || xc == "B3LYP" ||
+                          xc.find(" HF:") != string::npos;
+      if ( hybrid && s->symmetries.size() > 1 )
+      {
+        if ( onpe0 )
+          cout << " kpoint mesh: symmetry reduction cannot be used with"
+               << " hybrid functionals. Use symmetry off" << endl;
+        return 1;
+      }
+      vector<D3vector> kp;
+      vector<double> w;
+      const int nsym = s->symmetries.irreducible_kpoints(n,shift,kp,w);
+      s->wf.set_kpoints(kp,w);
+      if ( onpe0 )
+        cout << " kpoint mesh: " << kp.size() << " irreducible kpoints, "
+             << nsym << " symmetry operations used" << endl;
+    }
     else if ( subcmd == "list" )
     {
       if ( argc != 2 )
@@ -0,0 +1,53 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2011 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// LBFGSCellStepper.h:
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LBFGSCELLSTEPPER_H
+#define LBFGSCELLSTEPPER_H
+
+#include "RelaxCellStepper.h"
+#include "LBFGSOptimizer.h"
+
+class LBFGSCellStepper : public RelaxCellStepper
+{
+  private:
+
+  LBFGSOptimizer lbfgs_;
+
+  void compute_xp(const std::valarray<double>& x, double e,
+    std::valarray<double>& g, std::valarray<double>& xp)
+  {
+    lbfgs_.compute_xp(x,e,g,xp);
+    if ( s_.ctxt_.onpe0() )
+      std::cout << "  LBFGSCellStepper: nhist = " << lbfgs_.nhist()
+                << " gamma = " << lbfgs_.gamma() << std::endl;
+  }
+
+  public:
+
+  LBFGSCellStepper(Sample& s) : RelaxCellStepper(s),
+    lbfgs_(LBFGSOptimizer(3*s.atoms.size()+9))
+  {
+    lbfgs_.set_alpha_start(1.0);
+    lbfgs_.set_max_step(0.2);
+#ifdef DEBUG
+    if ( s.ctxt_.onpe0() )
+      lbfgs_.set_debug_print();
+#endif
+  }
+};
+#endif
@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2011 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// LBFGSIonicStepper.h:
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LBFGSIONICSTEPPER_H
+#define LBFGSIONICSTEPPER_H
+
+#include "IonicStepper.h"
+#include "LBFGSOptimizer.h"
+#include "ModelHessian.h"
+
+class LBFGSIonicStepper : public IonicStepper
+{
+  private:
+
+  LBFGSOptimizer lbfgs_;
+  ModelHessian mh_;
+  bool use_mh_;
+
+  public:
+
+  LBFGSIonicStepper(Sample& s);
+  void compute_r(double e0, const std::vector<std::vector< double> >& f0);
+  void compute_v(double e0, const std::vector<std::vector< double> >& f0) {}
+  void reset(void) { lbfgs_.reset(); }
+};
+#endif
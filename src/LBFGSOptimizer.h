@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2011 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// LBFGSOptimizer.h:
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Limited memory BFGS optimizer without line search
+// One function and gradient evaluation is used per step. The step is
+// limited to a maximum displacement of max_step in any component.
+// If a model Hessian P is given, the initial inverse Hessian is gamma*P^-1
+
+#ifndef LBFGSOPTIMIZER_H
+#define LBFGSOPTIMIZER_H
+
+#include <valarray>
+#include <deque>
+
+class ModelHessian;
+
+class LBFGSOptimizer
+{
+  private:
+
+  int n_, m_;
+  bool first_step_, debug_print;
+  std::deque<std::valarray<double> > s_, y_;
+  std::deque<double> rho_;
+  std::valarray<double> x0_, g0_;
+  double f0_, alpha_start_, max_step_, gamma_;
+  const ModelHessian* mh_;
+  double dot(std::valarray<double>& a, std::valarray<double>& b);
+  void apply_h0(const std::valarray<double>& q, std::valarray<double>& r);
+
+  public:
+
+  LBFGSOptimizer(int n, int m = 10): n_(n), m_(m), first_step_(true),
+    debug_print(false), f0_(0.0), alpha_start_(1.0), max_step_(0.0),
+    gamma_(1.0), mh_(0)
+  {
+    x0_.resize(n);
+    g0_.resize(n);
+  }
+
+  void reset(void);
+  void set_alpha_start(double a) { alpha_start_ = a; }
+  void set_max_step(double d) { max_step_ = d; }
+  void set_model_hessian(const ModelHessian* mh) { mh_ = mh; }
+  void set_debug_print(void) { debug_print = true; }
+
+  int size(void) const { return n_; }
+  int memory(void) const { return m_; }
+  int nhist(void) const { return s_.size(); }
+  double alpha_start(void) const { return alpha_start_; }
+  double max_step(void) const { return max_step_; }
+  double gamma(void) const { return gamma_; }
+  void compute_xp(const std::valarray<double>& x, const double f,
+                  std::valarray<double>& g, std::valarray<double>& xp);
+};
+#endif
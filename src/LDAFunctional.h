@@ -66,5 +66,7 @@ class LDAFunctional : public XCFunctional
   bool isGGA() const { return false; };
   std::string name() const { return "LDA"; };
   void setxc(void);
+  bool batched(void) const { return true; }
+  void setxc_batch(int first, int n);
 };
 #endif
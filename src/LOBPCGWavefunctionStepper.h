@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// LOBPCGWavefunctionStepper.h
+//
+// Block preconditioned eigensolver: Rayleigh-Ritz on the subspace [Y,W,P]
+// of the current states Y, the preconditioned residuals W and the previous
+// search directions P. Converged bands are soft-locked: their residual and
+// search directions are removed from the subspace but the bands remain
+// part of the Rayleigh-Ritz step. The image HP of the search directions
+// is recomputed if the potential has changed since the last step.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LOBPCGWAVEFUNCTIONSTEPPER_H
+#define LOBPCGWAVEFUNCTIONSTEPPER_H
+
+#include "WavefunctionStepper.h"
+#include "Wavefunction.h"
+#include <vector>
+class Preconditioner;
+class EnergyFunctional;
+
+class LOBPCGWavefunctionStepper : public WavefunctionStepper
+{
+  private:
+
+  Preconditioner& prec_;
+  EnergyFunctional& ef_;
+  // wft_, dwft_: Y, HY   wfp_, dwfp_: P, HP
+  Wavefunction wft_, dwft_, wfp_, dwfp_;
+  bool p_valid_;
+  // value of ef_.nupdate_vhxc() when HP was computed
+  int hp_nupdate_vhxc_;
+  // bands with a residual norm smaller than lock_tol_ are locked
+  double lock_tol_;
+
+  public:
+
+  void update(Wavefunction& dwf);
+  // discard the search directions P
+  virtual void preprocess(void) { p_valid_ = false; }
+
+  LOBPCGWavefunctionStepper(Wavefunction& wf, Preconditioner& prec,
+                            EnergyFunctional& ef, double scf_tol,
+                            TimerMap& tmap);
+  ~LOBPCGWavefunctionStepper();
+};
+#endif
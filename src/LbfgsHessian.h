@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// LbfgsHessian.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Initial inverse Hessian of the L-BFGS ionic stepper (atoms_dyn LBFGS)
+// lbfgs_hessian = IDENTITY: scaled identity
+// lbfgs_hessian = MODEL: scaled inverse of a model Hessian computed from
+// interatomic distances
+
+#ifndef LBFGSHESSIAN_H
+#define LBFGSHESSIAN_H
+
+#include<iostream>
+#include<iomanip>
+#include<sstream>
+#include<stdlib.h>
+
+#include "Sample.h"
+
+class LbfgsHessian : public Var
+{
+  Sample *s;
+
+  public:
+
+  const char *name ( void ) const { return "lbfgs_hessian"; };
+
+  int set ( int argc, char **argv )
+  {
+    if ( argc != 2 )
+    {
+      if ( ui->onpe0() )
+      cout << " lbfgs_hessian takes only one value" << endl;
+      return 1;
+    }
+
+    string v = argv[1];
+    if ( !( v == "IDENTITY" || v == "MODEL" ) )
+    {
+      if ( ui->onpe0() )
+        cout << " lbfgs_hessian must be IDENTITY or MODEL" << endl;
+      return 1;
+    }
+
+    s->ctrl.lbfgs_hessian = v;
+
+    return 0;
+  }
+
+  string print (void) const
+  {
+     ostringstream st;
+     st.setf(ios::left,ios::adjustfield);
+     st << setw(10) << name() << " = ";
+     st.setf(ios::right,ios::adjustfield);
+     st << setw(10) << s->ctrl.lbfgs_hessian;
+     return st.str();
+  }
+
+  LbfgsHessian(Sample *sample) : s(sample) { s->ctrl.lbfgs_hessian = "IDENTITY"; }
+};
+#endif
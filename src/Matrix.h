@@ -248,6 +248,9 @@ class DoubleMatrix
 
     // Cholesky decomposition of a symmetric matrix
     void potrf(char uplo);
+    // Cholesky decomposition, returns info > 0 instead of aborting
+    // if the matrix is not positive definite
+    int potrf_info(char uplo);
     // Inverse of a symmetric matrix from Cholesky factor
     void potri(char uplo);
 
@@ -447,6 +450,8 @@ class ComplexMatrix
     }
 
     ComplexMatrix& operator=(const ComplexMatrix& a);
+    // exchange the local arrays of two matrices of identical distribution
+    void swap(ComplexMatrix& a);
 
     ComplexMatrix& operator+=(const ComplexMatrix& a);
     ComplexMatrix& operator-=(const ComplexMatrix& a);
@@ -534,6 +539,9 @@ class ComplexMatrix
 
     // Cholesky decomposition of a hermitian matrix
     void potrf(char uplo);
+    // Cholesky decomposition, returns info > 0 instead of aborting
+    // if the matrix is not positive definite
+    int potrf_info(char uplo);
     // Inverse of a symmetric matrix from Cholesky factor
     void potri(char uplo);
 
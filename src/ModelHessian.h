@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2011 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// ModelHessian.h:
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Model Hessian of the atomic positions derived from interatomic distances
+// P = mu * ( sum_ij w_ij (e_i-e_j)(e_i-e_j)^T x I3 + c_stab I )
+// w_ij = exp(-A*(r_ij/r_nn-1)) for r_ij < 2*r_nn, where r_nn is the average
+// nearest neighbor distance
+// D.Packwood et al., J. Chem. Phys. 144, 164109 (2016)
+// Distances use the minimum image convention
+
+#ifndef MODELHESSIAN_H
+#define MODELHESSIAN_H
+
+#include <vector>
+#include <valarray>
+class UnitCell;
+
+class ModelHessian
+{
+  private:
+
+  int nat_;
+  double mu_, c_stab_, a_, r_nn_;
+  std::vector<int> pi_, pj_;
+  std::vector<double> w_;
+
+  public:
+
+  ModelHessian(int nat) : nat_(nat), mu_(0.2), c_stab_(0.1), a_(3.0),
+    r_nn_(0.0) {}
+
+  // compute the pair weights at positions r[is][3*ia+j]
+  void update(const std::vector<std::vector<double> >& r,
+              const UnitCell& cell);
+
+  int size(void) const { return 3*nat_; }
+  int npairs(void) const { return w_.size(); }
+  double r_nn(void) const { return r_nn_; }
+
+  // y = P x
+  void apply(const std::valarray<double>& x, std::valarray<double>& y) const;
+  // solve P x = b
+  void solve(const std::valarray<double>& b, std::valarray<double>& x) const;
+};
+#endif
@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// MtsNstep.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Number of inner steps of multiple time step MD with hybrid functionals
+// The inner steps use the semilocal functional underlying the hybrid
+// functional. The difference between hybrid and semilocal forces is
+// applied as an impulse every mts_nstep steps.
+// Each run starts with an outer step, and should consist of a multiple of
+// mts_nstep steps so that it also ends on an outer step.
+// mts_nstep = 1: the hybrid functional is used at every step
+
+#ifndef MTSNSTEP_H
+#define MTSNSTEP_H
+
+#include<iostream>
+#include<iomanip>
+#include<sstream>
+#include<stdlib.h>
+
+#include "Sample.h"
+
+class MtsNstep : public Var
+{
+  Sample *s;
+
+  public:
+
+  const char *name ( void ) const { return "mts_nstep"; };
+
+  int set ( int argc, char **argv )
+  {
+    if ( argc != 2 )
+    {
+      if ( ui->onpe0() )
+      cout << " mts_nstep must be a positive integer" << endl;
+      return 1;
+    }
+
+    int v = atoi(argv[1]);
+    if ( v <= 0 )
+    {
+      if ( ui->onpe0() )
+        cout << " mts_nstep must be a positive integer" << endl;
+      return 1;
+    }
+    s->ctrl.mts_nstep = v;
+    return 0;
+  }
+
+  string print (void) const
+  {
+     ostringstream st;
+     st.setf(ios::left,ios::adjustfield);
+     st << setw(10) << name() << " = ";
+     st.setf(ios::right,ios::adjustfield);
+     st << setw(10) << s->ctrl.mts_nstep;
+     return st.str();
+  }
+
+  MtsNstep(Sample *sample) : s(sample) { s->ctrl.mts_nstep = 1; };
+};
+#endif
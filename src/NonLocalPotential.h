@@ -25,6 +25,7 @@
 #include "SlaterDet.h"
 #include "Context.h"
 #include "Matrix.h"
+#include "Workspace.h"
 
 class NonLocalPotential
 {
@@ -54,6 +55,9 @@ class NonLocalPotential
   // wquad[is][iquad], iquad = 0, nquad[is]-1
   std::vector<std::vector<double> > wquad;
 
+  // temporaries of energy(), released when the cell changes
+  Workspace ws_;
+
   mutable TimerMap tmap;
   void init(void);
 
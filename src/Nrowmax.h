@@ -24,6 +24,7 @@
 #include<iomanip>
 #include<sstream>
 #include<stdlib.h>
+#include<string.h>
 
 #include "Sample.h"
 
@@ -37,19 +38,44 @@ class Nrowmax : public Var
 
   int set ( int argc, char **argv )
   {
-    if ( argc != 2 )
+    int v;
+    if ( argc > 1 && !strcmp(argv[1],"auto") )
     {
-      if ( ui->onpe0() )
-      cout << " nrowmax takes only one value" << endl;
-      return 1;
+      // set nrowmax auto [ntrial]: select nrowmax using a performance model
+      // and optional timed trials of the ntrial best process grids
+      if ( argc > 3 )
+      {
+        if ( ui->onpe0() )
+          cout << " use: set nrowmax auto [ntrial]" << endl;
+        return 1;
+      }
+      if ( s->wf.ecut() == 0.0 || s->wf.nst() == 0 )
+      {
+        if ( ui->onpe0() )
+          cout << " nrowmax auto: ecut and nel must be defined" << endl;
+        return 1;
+      }
+      const int ntrial = ( argc == 3 ) ? atoi(argv[2]) : 0;
+      v = s->wf.select_nrowmax(ntrial);
+      if ( v == s->wf.nrowmax() )
+        return 0;
     }
-
-    int v = atoi(argv[1]);
-    if ( v <= 0 )
+    else
     {
-      if ( ui->onpe0() )
-        cout << " nrowmax must be positive" << endl;
-      return 1;
+      if ( argc != 2 )
+      {
+        if ( ui->onpe0() )
+        cout << " nrowmax takes only one value" << endl;
+        return 1;
+      }
+
+      v = atoi(argv[1]);
+      if ( v <= 0 )
+      {
+        if ( ui->onpe0() )
+          cout << " nrowmax must be positive" << endl;
+        return 1;
+      }
     }
 
     s->wf.set_nrowmax(v);
@@ -35,7 +35,7 @@ class PBEFunctional : public XCFunctional
     double b1, double b2, double b3,
     double b4, double rtrs, double *gg, double *ggrs);
 
-  void excpbe(double rho, double grad,
+  void excpbe(double rho, double grad, double x_coeff, double c_coeff,
     double *exc, double *vxc1, double *vxc2);
 
   void excpbe_sp(double rho_up, double rho_dn,
@@ -54,5 +54,7 @@ class PBEFunctional : public XCFunctional
   bool isGGA() const { return true; };
   std::string name() const { return "PBE"; };
   void setxc(void);
+  bool batched(void) const { return true; }
+  void setxc_batch(int first, int n);
 };
 #endif
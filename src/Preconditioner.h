@@ -21,6 +21,7 @@
 
 class Wavefunction;
 class EnergyFunctional;
+class ComplexMatrix;
 
 #include <vector>
 #include <valarray>
@@ -45,6 +46,11 @@ class Preconditioner
 
   double diag(int ispin, int ikp, int n, int ig) const;
 
+  // z = beta * z + alpha * K r for all local columns of a SlaterDet
+  // coefficient block. z and r may be the same matrix.
+  void apply(int ispin, int ikp, double alpha, const ComplexMatrix& r,
+             ComplexMatrix& z, double beta) const;
+
   Preconditioner(const Wavefunction& wf, EnergyFunctional& ef, double ecutprec);
   //~Preconditioner();
 };
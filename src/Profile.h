@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// Profile.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include<iostream>
+#include<iomanip>
+#include<sstream>
+#include<stdlib.h>
+
+#include "Sample.h"
+#include "Profiler.h"
+
+class Profile : public Var
+{
+  Sample *s;
+
+  public:
+
+  const char *name ( void ) const { return "profile"; };
+
+  int set ( int argc, char **argv )
+  {
+    // use: set profile OFF | XML | JSON [period [prefix]]
+    if ( argc < 2 || argc > 4 )
+    {
+      if ( ui->onpe0() )
+      cout << " use: set profile OFF|XML|JSON [period [prefix]]" << endl;
+      return 1;
+    }
+
+    string v = argv[1];
+    Profiler& p = Profiler::instance();
+    if ( v == "OFF" )
+      p.set_format(Profiler::OFF);
+    else if ( v == "XML" )
+      p.set_format(Profiler::XML);
+    else if ( v == "JSON" )
+      p.set_format(Profiler::JSON);
+    else
+    {
+      if ( ui->onpe0() )
+        cout << " profile must be in [OFF,XML,JSON]" << endl;
+      return 1;
+    }
+
+    if ( argc > 2 )
+    {
+      int period = atoi(argv[2]);
+      if ( period <= 0 )
+      {
+        if ( ui->onpe0() )
+          cout << " profile period must be positive" << endl;
+        return 1;
+      }
+      p.set_period(period);
+    }
+    if ( argc > 3 )
+      p.set_prefix(argv[3]);
+
+    return 0;
+  }
+
+  string print (void) const
+  {
+     const Profiler& p = Profiler::instance();
+     const char* fmt[] = { "OFF", "XML", "JSON" };
+     ostringstream st;
+     st.setf(ios::left,ios::adjustfield);
+     st << setw(10) << name() << " = ";
+     st.setf(ios::right,ios::adjustfield);
+     st << setw(10) << fmt[p.format()];
+     if ( p.enabled() )
+       st << " " << p.period() << " " << p.prefix();
+     return st.str();
+  }
+
+  Profile(Sample *sample) : s(sample) {};
+};
+#endif
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// Profiler.h
+//
+// Process-wide instrumentation: nested timed regions forming a call tree,
+// communication, FFT and flop counters attributed to the current region.
+// Each task writes its own records to <prefix>.<rank>.xml or .json
+// (one JSON object per line) every period iterations.
+//
+// Regions and counters must be entered from the master thread only,
+// i.e. outside of OpenMP parallel regions.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <string>
+#include <vector>
+#include <map>
+#include <iosfwd>
+
+class Profiler
+{
+  public:
+
+  enum Format { OFF, XML, JSON };
+  enum Counter { A2AV_BYTES, A2AV_CALLS, ALLRED_BYTES, ALLRED_CALLS,
+                 FFT_CALLS, FFT_FLOPS, GEMM_FLOPS, NCOUNTERS };
+
+  private:
+
+  struct Node
+  {
+    std::string name;
+    int parent;
+    std::map<std::string,int> child;
+    long int ncalls, ncalls_i;
+    double time, time_i;  // cumulative and current interval times
+    double tstart;
+    double cnt[NCOUNTERS], cnt_i[NCOUNTERS];
+  };
+
+  std::vector<Node> node_;
+  int current_;
+  Format format_;
+  int period_;
+  int iter_;
+  std::string prefix_;
+
+  int new_node(const std::string& name, int parent);
+  void write_node_xml(std::ostream& os, int inode, int level) const;
+  void write_node_json(std::ostream& os, int inode) const;
+
+  Profiler(void);
+  Profiler(const Profiler&);
+  Profiler& operator=(const Profiler&);
+
+  public:
+
+  static Profiler& instance(void);
+  static const char* counter_name(int i);
+  static double wtime(void);
+
+  bool enabled(void) const { return format_ != OFF; }
+  Format format(void) const { return format_; }
+  int period(void) const { return period_; }
+  const std::string& prefix(void) const { return prefix_; }
+  void set_format(Format f) { format_ = f; }
+  void set_period(int p) { period_ = p > 0 ? p : 1; }
+  void set_prefix(const std::string& p) { prefix_ = p; }
+
+  void start(const char* name);
+  void stop(void);
+  void count(Counter c, double v)
+  {
+    if ( format_ == OFF ) return;
+    node_[current_].cnt[c] += v;
+    node_[current_].cnt_i[c] += v;
+  }
+
+  // mark the end of an outer iteration; write a record every period_ calls
+  void end_iteration(void);
+  // write a record of the current interval and reset interval data
+  void write(void);
+  void reset(void);
+};
+
+// scoped region: Profiler regions are closed on all return paths
+class ProfileRegion
+{
+  bool active_;
+
+  public:
+
+  explicit ProfileRegion(const char* name) :
+    active_(Profiler::instance().enabled())
+  { if ( active_ ) Profiler::instance().start(name); }
+  ~ProfileRegion(void)
+  { if ( active_ ) Profiler::instance().stop(); }
+};
+#endif
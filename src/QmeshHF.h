@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// QmeshHF.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QMESHHF_H
+#define QMESHHF_H
+
+#include<iostream>
+#include<iomanip>
+#include<sstream>
+#include<stdlib.h>
+
+#include "Sample.h"
+
+class QmeshHF : public Var
+{
+  Sample *s;
+
+  public:
+
+  const char *name ( void ) const { return "qmeshHF"; };
+
+  int set ( int argc, char **argv )
+  {
+    if ( argc != 4 )
+    {
+      if ( ui->onpe0() )
+      cout << " qmeshHF takes 3 integer values" << endl;
+      return 1;
+    }
+
+    int v0 = atoi(argv[1]);
+    int v1 = atoi(argv[2]);
+    int v2 = atoi(argv[3]);
+    // 0 0 0: use all kpoints in the exchange operator
+    const bool off = v0 == 0 && v1 == 0 && v2 == 0;
+    if ( !off && ( v0 <= 0 || v1 <= 0 || v2 <= 0 ) )
+    {
+      if ( ui->onpe0() )
+        cout << " qmeshHF values must be all > 0 or all 0" << endl;
+      return 1;
+    }
+
+    s->ctrl.qmeshHF[0] = v0;
+    s->ctrl.qmeshHF[1] = v1;
+    s->ctrl.qmeshHF[2] = v2;
+
+    return 0;
+  }
+
+  string print (void) const
+  {
+     ostringstream st;
+     st.setf(ios::left,ios::adjustfield);
+     st << setw(10) << name() << " = ";
+     st.setf(ios::right,ios::adjustfield);
+     st << s->ctrl.qmeshHF[0] << " "
+        << s->ctrl.qmeshHF[1] << " "
+        << s->ctrl.qmeshHF[2] << " ";
+     return st.str();
+  }
+
+  QmeshHF(Sample *sample) : s(sample)
+  {
+    s->ctrl.qmeshHF[0] = 0;
+    s->ctrl.qmeshHF[1] = 0;
+    s->ctrl.qmeshHF[2] = 0;
+  }
+};
+#endif
@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2011 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// RelaxCellMap.h:
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Variables of the combined relaxation of atoms and cell (RelaxCellStepper)
+// The cell is A = (I+U) A0 and the positions are R = (I+U) X, where A0 is
+// the reference cell and U the symmetric part of the strain tensor u[9].
+// Symmetric 3x3 matrices are stored as xx, yy, zz, xy, yz, xz.
+
+#ifndef RELAXCELLMAP_H
+#define RELAXCELLMAP_H
+
+#include <valarray>
+class UnitCell;
+
+class RelaxCellMap
+{
+  public:
+
+  // symmetric matrix I+U from the strain tensor u[9]
+  static void iu_matrix(const double* u, double* iumat);
+
+  // cell A = (I+U) A0
+  static void cell(const double* iumat, const UnitCell& cell0,
+                   UnitCell& cell);
+
+  // positions R = (I+U) X
+  static void position(const double* iumat, const double* x, double* r);
+
+  // gradient with respect to X: dE/dX = (I+U) dE/dR
+  static void position_gradient(const double* iumat, const double* gr,
+                                double* gx);
+
+  // gradient with respect to u[9] at constant X, from the stress sigma
+  // (xx, yy, zz, xy, yz, xz) and the volume of A:
+  // dE/du = - volume * sym( sigma (I+U)^-1 )
+  static void strain_gradient(const double* iumat,
+                              const std::valarray<double>& sigma,
+                              double volume, double* gu);
+};
+#endif
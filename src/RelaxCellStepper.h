@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2011 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// RelaxCellStepper.h:
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Combined relaxation of atomic positions and unit cell
+// The variables are the positions X = (I+U)^-1 R mapped to the reference
+// cell cell0 and the strain U scaled by cell_factor = sqrt(natoms)
+// (see RelaxCellMap). The optimization step is defined by the derived class
+
+#ifndef RELAXCELLSTEPPER_H
+#define RELAXCELLSTEPPER_H
+
+#include "CellStepper.h"
+
+class RelaxCellStepper : public CellStepper
+{
+  protected:
+
+  UnitCell cell0;
+  std::vector<std::vector<double> > rp_;
+
+  int nat_;
+  double cell_factor_;
+
+  virtual void compute_xp(const std::valarray<double>& x, double e,
+    std::valarray<double>& g, std::valarray<double>& xp) = 0;
+
+  public:
+
+  RelaxCellStepper(Sample& s);
+  void compute_new_cell(double e0, const std::valarray<double>& sigma,
+                        const std::vector<std::vector< double> >& fion);
+  void update_cell(void);
+  double ekin(void) const { return 0.0; }
+};
+#endif
@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// ReplicaSet.h
+//
+// Partition of a communicator into nrep groups of equal size, each running
+// an independent replica (Context, Sample and input script). Tasks having
+// the same rank in their replica are connected by the inter-replica
+// communicator xcomm, used to exchange replicated data (e.g. atomic
+// positions) between replicas.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef REPLICASET_H
+#define REPLICASET_H
+
+#include <vector>
+#include <mpi.h>
+
+class ReplicaSet
+{
+  private:
+
+  int nrep_;       // number of replicas
+  int irep_;       // index of the replica of the current task
+  MPI_Comm comm_;  // tasks of the current replica
+  MPI_Comm xcomm_; // tasks having the same rank in all replicas
+
+  ReplicaSet(const ReplicaSet&);
+  ReplicaSet& operator=(const ReplicaSet&);
+
+  public:
+
+  int nrep(void) const { return nrep_; }
+  int irep(void) const { return irep_; }
+  MPI_Comm comm(void) const { return comm_; }
+  MPI_Comm xcomm(void) const { return xcomm_; }
+
+  // gather the vectors v of all replicas in w = { v_0, v_1, ... }
+  // v must have the same size in all replicas
+  void allgather(const std::vector<double>& v, std::vector<double>& w) const;
+  // swap the contents of v with those of replica jrep
+  void exchange(std::vector<double>& v, int jrep) const;
+  // sum of a over all replicas
+  double sum(double a) const;
+  // synchronize all tasks of all replicas
+  void barrier(void) const;
+
+  // split comm into nrep replicas of consecutive ranks
+  ReplicaSet(MPI_Comm comm, int nrep);
+  ~ReplicaSet(void);
+};
+#endif
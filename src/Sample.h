@@ -22,11 +22,13 @@
 #include "AtomSet.h"
 #include "ConstraintSet.h"
 #include "ExtForceSet.h"
+#include "SymmetrySet.h"
 #include "Wavefunction.h"
 #include "Control.h"
 
 class Context;
 class UserInterface;
+class ReplicaSet;
 
 class Sample
 {
@@ -39,20 +41,24 @@ class Sample
   AtomSet atoms;
   ConstraintSet constraints;
   ExtForceSet extforces;
+  SymmetrySet symmetries;
   Wavefunction wf;
   Wavefunction* wfv; // wavefunction velocity
   Control ctrl;
   UserInterface *ui;
+  const ReplicaSet *replicas; // other replicas of a multi-replica run, or 0
 
   Sample(const Context& ctxt, UserInterface *ui_ = 0) : ctxt_(ctxt), ui(ui_),
+    replicas(0),
     atoms(ctxt), constraints(ctxt),
-    extforces(ctxt), wf(ctxt), wfv(0) {}
+    extforces(ctxt), symmetries(ctxt), wf(ctxt), wfv(0) {}
   ~Sample(void) { delete wfv; }
   void reset(void)
   {
     atoms.reset();
     constraints.reset();
     extforces.reset();
+    symmetries.reset();
     wf.reset();
     delete wfv;
   }
@@ -23,6 +23,7 @@ class FourierTransform;
 #include "Context.h"
 #include "Basis.h"
 #include "Matrix.h"
+#include "Workspace.h"
 
 #include "D3vector.h"
 #include <iosfwd>
@@ -44,6 +45,8 @@ class SlaterDet
   ComplexMatrix c_;
   std::vector<double> occ_;
   std::vector<double> eig_;
+  // temporaries of hot routines, released when the basis is resized
+  mutable Workspace ws_;
 
   void byteswap_double(size_t n, double* x);
   double fermi(double e, double mu, double fermitemp);
@@ -59,6 +62,7 @@ class SlaterDet
   const Basis& basis(void) const { return *basis_; }
   const D3vector kpoint(void) const { return basis_->kpoint(); }
   const ComplexMatrix& c(void) const { return c_; }
+  Workspace& workspace(void) const { return ws_; }
   ComplexMatrix& c(void) { return c_; }
   const std::vector<double>& occ(void) const { return occ_; }
   const std::vector<double>& eig(void) const { return eig_; }
@@ -134,6 +134,13 @@ class Species
   { return ztot_ * ztot_ / ( sqrt ( 2.0 * M_PI ) * rcps_ ); };
 
   void phi(int l, double r, double &val);              // phi(l,r) in r space
+  // true if the atomic wavefunction phi(l,r) is defined
+  bool has_phi(int l) const
+  { return l >= 0 && l < phi_.size() && phi_[l].size() > 0; }
+  void phig(int l, double q, double &val) const;       // phi(l,q) in g space
+  // 4 pi \int r^2 j_l(qr) f(r) dr, f given on the mesh r_i = i*dr, l <= 3
+  static void bessel_transform(int l, const std::vector<double>& f,
+                               double dr, double q, double &val);
   void vpsr(int l, double r, double &v);               // Vps(l,r) in r space
   void dvpsr(int l, double r, double &v, double &dv);  // Vps and dVps/dr
   void vlocg(double q, double &v);                     // Vloc(g)
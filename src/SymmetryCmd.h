@@ -0,0 +1,101 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// SymmetryCmd.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SYMMETRYCMD_H
+#define SYMMETRYCMD_H
+
+#include <iostream>
+#include "UserInterface.h"
+#include "Sample.h"
+#include <cstdlib>
+
+class SymmetryCmd : public Cmd
+{
+  public:
+
+  Sample *s;
+
+  SymmetryCmd(Sample *sample) : s(sample) {};
+
+  const char *name(void) const { return "symmetry"; }
+  const char *help_msg(void) const
+  {
+    return
+    "\n symmetry\n\n"
+    " syntax:\n\n"
+    "   symmetry find [tol]\n"
+    "   symmetry list\n"
+    "   symmetry off\n\n"
+    "   The symmetry find command finds the space group of the current\n"
+    "   atomic positions with a distance tolerance tol (default 1.e-5 bohr).\n"
+    "   The charge density, forces and stress are then symmetrized and\n"
+    "   kpoint mesh generates irreducible kpoints. Operations broken by\n"
+    "   atomic displacements are removed. A run stops if an operation\n"
+    "   used by kpoint mesh is broken: use symmetry off and kpoint mesh\n"
+    "   to define the full mesh. Irreducible kpoints cannot be used with\n"
+    "   hybrid functionals.\n\n";
+  }
+
+  int action(int argc, char **argv)
+  {
+    const bool onpe0 = s->ctxt_.onpe0();
+    if ( argc < 2 )
+    {
+      if ( onpe0 )
+        cout << help_msg();
+      return 1;
+    }
+    string subcmd(argv[1]);
+    if ( subcmd == "find" && argc <= 3 )
+    {
+      double tol = 1.e-5;
+      if ( argc == 3 )
+        tol = atof(argv[2]);
+      if ( tol <= 0.0 )
+      {
+        if ( onpe0 )
+          cout << " symmetry: tol must be positive" << endl;
+        return 1;
+      }
+      const int nsym = s->symmetries.find(s->atoms,tol);
+      if ( onpe0 )
+        cout << " symmetry: " << nsym << " symmetry operations found" << endl;
+    }
+    else if ( subcmd == "list" && argc == 2 )
+    {
+      if ( onpe0 )
+        s->symmetries.print(cout);
+    }
+    else if ( subcmd == "off" && argc == 2 )
+    {
+      s->symmetries.remove_operations();
+      if ( onpe0 && s->symmetries.kpoints_reduced() )
+        cout << " symmetry: warning: the kpoint set was reduced using"
+             << " symmetry operations.\n Use kpoint mesh to define"
+             << " the full mesh" << endl;
+    }
+    else
+    {
+      if ( onpe0 )
+        cout << help_msg();
+      return 1;
+    }
+    return 0;
+  }
+};
+#endif
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// SymmetrySet.h
+//
+// Space group operations {R|t} of a sample. An operation maps the crystal
+// coordinates x of a point to R x + t, where R is an integer 3x3 matrix
+// and t a fractional translation. One translation is kept per rotation:
+// pure translations of supercells are not included, so that the set is a
+// group only for primitive cells.
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SYMMETRYSET_H
+#define SYMMETRYSET_H
+
+#include "D3vector.h"
+#include "UnitCell.h"
+#include <vector>
+#include <valarray>
+#include <complex>
+#include <iosfwd>
+
+class AtomSet;
+class Basis;
+class Context;
+
+class Symmetry
+{
+  public:
+
+  int r[9];    // r[3*i+j] = R_ij in crystal coordinates
+  D3vector t;  // fractional translation in crystal coordinates
+
+  bool is_identity(double tol) const;
+};
+
+class SymmetrySet
+{
+  private:
+
+  const Context& ctxt_;
+  double tol_;
+  UnitCell cell_;
+  std::vector<Symmetry> sym_;
+  // operations other than the identity used to reduce the kpoint mesh
+  std::vector<Symmetry> kops_;
+  // perm_[iop][is][ia]: index of the image of atom ia of species is
+  std::vector<std::vector<std::vector<int> > > perm_;
+
+  // mapping of the local g vectors of a basis for the symmetrization
+  // of densities: gmap_[ig*nsym+iop] is the position of R^T g in the
+  // receive buffer rbuf_, or -(position+1) if -R^T g is stored (real basis)
+  // Only the values f(R^T g) needed by the local g vectors are exchanged:
+  // task ipe receives rcounts_[ipe] values, and sends the values at the
+  // local indices isend_[sdispl_[ipe]..] (counts and displacements in
+  // units of double)
+  const Basis* gbasis_;
+  int gbasis_size_;
+  std::vector<int> gmap_;
+  std::vector<std::complex<double> > gphase_;
+  std::vector<int> scounts_, sdispl_, rcounts_, rdispl_;
+  std::vector<int> isend_;
+  std::vector<std::complex<double> > sbuf_, rbuf_;
+
+  void setup_gmap(const Basis& basis);
+  bool map_atoms(const Symmetry& s,
+                 const std::vector<std::vector<double> >& tau,
+                 std::vector<std::vector<int> >& perm) const;
+  D3vector crystal(const D3vector& r) const;
+  void cartesian_rotation(const Symmetry& s, double* rc) const;
+
+  public:
+
+  SymmetrySet(const Context& ctxt) : ctxt_(ctxt), tol_(1.e-5),
+    gbasis_(0), gbasis_size_(0) {}
+
+  int size(void) const { return sym_.size(); }
+  double tol(void) const { return tol_; }
+  const Symmetry& sym(int iop) const { return sym_[iop]; }
+
+  // find the space group of the atomic positions, using a distance
+  // tolerance tol (bohr). Returns the number of operations found.
+  // The lattice is reduced before searching for rotations, so that
+  // operations of cells defined by long lattice vectors are found
+  int find(const AtomSet& atoms, double tol);
+  int find(const std::vector<std::vector<double> >& tau,
+           const UnitCell& cell, double tol);
+  // remove the operations that are no longer satisfied by the atomic
+  // positions. Returns the number of operations removed.
+  int check(const AtomSet& atoms);
+  int check(const std::vector<std::vector<double> >& tau,
+            const UnitCell& cell);
+  // remove all operations. The record of the operations used to reduce
+  // the kpoint mesh is kept
+  void remove_operations(void);
+  void reset(void);
+
+  // symmetrize a function of g defined on a distributed basis
+  void symmetrize(const Basis& basis, std::complex<double>* f);
+  void symmetrize_forces(std::vector<std::vector<double> >& f) const;
+  void symmetrize_stress(std::valarray<double>& sigma) const;
+
+  // irreducible wedge of a Monkhorst-Pack mesh n0 x n1 x n2
+  // k_i = (2j - n_i + 1 + s_i) / (2 n_i), j = 0,..,n_i-1
+  // Time reversal symmetry is always used. Returns the number of
+  // operations compatible with the mesh. The operations used are recorded
+  // until the next call or reset()
+  int irreducible_kpoints(const int n[3], const int s[3],
+                          std::vector<D3vector>& kpoint,
+                          std::vector<double>& weight);
+  // true if the kpoint set was reduced using operations other than
+  // the identity and time reversal
+  bool kpoints_reduced(void) const { return !kops_.empty(); }
+  // false if one of the operations used to reduce the kpoint mesh is
+  // no longer an operation of the sample
+  bool kpoints_valid(void) const;
+
+  void print(std::ostream& os) const;
+};
+#endif
@@ -82,10 +82,16 @@ class Timer
 
   double gtod(void)
   {
-    static struct timeval tv;
-    static struct timezone tz;
-    gettimeofday(&tv,&tz);
+#if defined(CLOCK_MONOTONIC)
+    // monotonic clock: not affected by system time adjustments
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC,&ts);
+    return ts.tv_sec + 1.e-9*ts.tv_nsec;
+#else
+    struct timeval tv;
+    gettimeofday(&tv,0);
     return tv.tv_sec + 1.e-6*tv.tv_usec;
+#endif
   }
 };
 #endif
@@ -26,6 +26,9 @@
 #include <iomanip>
 #include <list>
 #include <algorithm>
+#include <vector>
+#include <utility>
+#include <mpi.h>
 
 class UserInterface;
 
@@ -54,8 +57,12 @@ class UserInterface
   private:
 
   int readCmd(char *s, int max, std::istream &fp, bool echo);
+  void expand(char *s, int max) const;
   bool terminate_;
   bool onpe0_;
+  MPI_Comm comm_;
+  // names and values of variables substituted in command lines
+  std::vector<std::pair<std::string,std::string> > defs_;
 
   public:
 
@@ -114,9 +121,13 @@ class UserInterface
 
   void terminate(void) { terminate_ = true; }
 
+  // define a variable $name that is replaced by value in command lines
+  void define(const std::string& name, const std::string& value)
+  { defs_.push_back(std::make_pair(name,value)); }
+
   bool onpe0(void) const { return onpe0_; }
 
-  UserInterface(void);
+  UserInterface(MPI_Comm comm = MPI_COMM_WORLD);
   ~UserInterface(void);
 };
 #endif
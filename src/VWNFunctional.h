@@ -77,5 +77,7 @@ class VWNFunctional : public XCFunctional
   bool isGGA() const { return false; };
   std::string name() const { return "VWN"; };
   void setxc(void);
+  bool batched(void) const { return true; }
+  void setxc_batch(int first, int n);
 };
 #endif
@@ -99,8 +99,14 @@ class Wavefunction
   void set_nspin(int nspin);
   void set_deltaspin(int deltaspin);
   void set_nrowmax(int n);
+  // select nrowmax using a performance model of the process grid
+  // and optional timed trials of the ntrial best grids
+  int select_nrowmax(int ntrial) const;
   void add_kpoint(D3vector kpoint, double weight);
   void del_kpoint(D3vector kpoint);
+  // replace the kpoint set, e.g. with an irreducible mesh
+  void set_kpoints(const std::vector<D3vector>& kpoint,
+                   const std::vector<double>& weight);
 
   void randomize(double amplitude);
 
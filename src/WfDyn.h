@@ -48,10 +48,10 @@ class WfDyn : public Var
 
     string v = argv[1];
     if ( !( v == "LOCKED" || v == "SD" || v == "PSD" ||
-            v == "PSDA" || v == "JD" || v == "MD" ) )
+            v == "PSDA" || v == "JD" || v == "LOBPCG" || v == "MD" ) )
     {
       if ( ui->onpe0() )
-        cout << " wf_dyn must be in [LOCKED,SD,PSD,PSDA,JD,MD]" << endl;
+        cout << " wf_dyn must be in [LOCKED,SD,PSD,PSDA,JD,LOBPCG,MD]" << endl;
       return 1;
     }
 
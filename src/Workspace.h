@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// Workspace.h
+//
+// Named temporary buffers and matrices kept across calls. A buffer is
+// allocated on first use and reallocated only if a larger size is
+// requested. The contents of a buffer or matrix are undefined on return
+// from get(), dmatrix() or zmatrix(). All buffers are released by clear().
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <map>
+#include <string>
+#include "Matrix.h"
+
+class Workspace
+{
+  private:
+
+  struct Buffer
+  {
+    double* p;
+    size_t n;
+  };
+  std::map<std::string,Buffer> buf_;
+  std::map<std::string,DoubleMatrix*> dmat_;
+  std::map<std::string,ComplexMatrix*> zmat_;
+  double size_;       // current size in bytes
+  double high_water_; // largest size reached in bytes
+
+  void update_size(double delta);
+  Workspace& operator=(const Workspace&);
+
+  public:
+
+  // buffer of at least n doubles
+  double* get(const std::string& name, size_t n);
+  // m x n matrices distributed on ctxt
+  DoubleMatrix& dmatrix(const std::string& name, const Context& ctxt,
+    int m, int n, int mb, int nb);
+  ComplexMatrix& zmatrix(const std::string& name, const Context& ctxt,
+    int m, int n, int mb, int nb);
+  void clear(void);
+
+  double size(void) const { return size_; }
+  double high_water(void) const { return high_water_; }
+
+  Workspace(void) : size_(0.0), high_water_(0.0) {}
+  // a copy of a Workspace is empty
+  Workspace(const Workspace&) : size_(0.0), high_water_(0.0) {}
+  ~Workspace(void) { clear(); }
+};
+#endif
@@ -54,6 +54,7 @@
 #define XCFUNCTIONAL_H
 
 #include <string>
+#include <cassert>
 
 class XCFunctional
 {
@@ -89,5 +90,15 @@ class XCFunctional
   virtual ~XCFunctional() {}
 
   virtual void setxc(void) = 0;
+
+  // Batch interface
+  // setxc_batch(first,n) evaluates the functional on the grid points
+  // first <= i < first+n. Batches are independent and may be evaluated
+  // concurrently. Functionals without a batch kernel return false from
+  // batched() and must be evaluated with setxc()
+  enum { batch_size = 512 };
+  virtual bool batched(void) const { return false; }
+  virtual void setxc_batch(int first, int n)
+  { assert(!"XCFunctional::setxc_batch: no batch kernel"); }
 };
 #endif
@@ -31,8 +31,13 @@ class XCOperator
 
   XCPotential* xcp_;
   ExchangeOperator* xop_;
+  // semilocal functional underlying a hybrid functional
+  XCPotential* xcp_sl_;
+  std::string sl_name_;
+  bool semilocal_;
 
   const ChargeDensity& cd_;
+  const Control& ctrl_;
   double HFmixCoeff_ ;
   double exc_; // XC energy: includes local and HF terms
   double dxc_;
@@ -60,6 +65,12 @@ class XCOperator
   bool hasGGA(void) { return hasGGA_; };
   bool hasHF(void) { return hasHF_; };
 
+  // evaluate the semilocal functional underlying a hybrid functional
+  // instead of the hybrid functional (used in multiple time step MD)
+  bool hasSemilocal(void) { return !sl_name_.empty(); }
+  bool semilocal(void) { return semilocal_; }
+  void set_semilocal(bool b);
+
   void update(std::vector<std::vector<double> >& vr, bool compute_stress);
   void apply_self_energy(Wavefunction &dwf);
   void compute_stress(std::valarray<double>& sigma);
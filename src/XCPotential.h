@@ -36,9 +36,9 @@ class XCPotential
   const ChargeDensity& cd_;
   XCFunctional* xcf_;
 
-  std::vector<std::vector<double> > vxctmp;          // vxctmp[ispin][ir]
   std::vector<std::complex<double> > tmpr;           // tmpr[ir]
   std::vector<std::complex<double> > tmp1, tmp2;     // tmp1[ig], tmp2[ig]
+  std::vector<std::complex<double> > tmp3, tmp4;     // tmp3[ig], tmp4[ig]
 
   double exc_, dxc_;
   int nspin_;
@@ -48,6 +48,8 @@ class XCPotential
   FourierTransform& vft_;
   Basis& vbasis_;
 
+  void setxc_(void);
+
   public:
 
   const XCFunctional* xcf() { return xcf_; }
@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// Xlbomd.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+// Extended Lagrangian Born-Oppenheimer MD
+// xlbomd = K (3 <= K <= 7): the initial density of the scf at each MD step
+// is an auxiliary density propagated with dissipation of order K
+// xlbomd = 0: no auxiliary density
+
+#ifndef XLBOMD_H
+#define XLBOMD_H
+
+#include<iostream>
+#include<iomanip>
+#include<sstream>
+#include<stdlib.h>
+
+#include "Sample.h"
+
+class Xlbomd : public Var
+{
+  Sample *s;
+
+  public:
+
+  const char *name ( void ) const { return "xlbomd"; };
+
+  int set ( int argc, char **argv )
+  {
+    if ( argc != 2 )
+    {
+      if ( ui->onpe0() )
+      cout << " xlbomd must be 0 or an integer in [3,7]" << endl;
+      return 1;
+    }
+
+    int v = atoi(argv[1]);
+    if ( v != 0 && ( v < 3 || v > 7 ) )
+    {
+      if ( ui->onpe0() )
+        cout << " xlbomd must be 0 or an integer in [3,7]" << endl;
+      return 1;
+    }
+    s->ctrl.xlbomd = v;
+    return 0;
+  }
+
+  string print (void) const
+  {
+     ostringstream st;
+     st.setf(ios::left,ios::adjustfield);
+     st << setw(10) << name() << " = ";
+     st.setf(ios::right,ios::adjustfield);
+     st << setw(10) << s->ctrl.xlbomd;
+     return st.str();
+  }
+
+  Xlbomd(Sample *sample) : s(sample) { s->ctrl.xlbomd = 0; };
+};
+#endif
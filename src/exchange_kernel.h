@@ -0,0 +1,26 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// exchange_kernel.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef EXCHANGE_KERNEL_H
+#define EXCHANGE_KERNEL_H
+// interaction kernel of the exchange operator v(q2) and dv = -d(ln v)/d(q2)
+// mu = 0: bare Coulomb kernel v = 1/q2, the q2=0 term is treated by the
+// divergence correction
+// mu > 0: erfc-screened kernel v = (1-exp(-q2/(4mu^2)))/q2, finite at q2=0
+void exchange_kernel(double mu, double q2, double& v, double& dv);
+#endif
@@ -0,0 +1,35 @@
+////////////////////////////////////////////////////////////////////////////////
+//
+// Copyright (c) 2008 The Regents of the University of California
+//
+// This file is part of Qbox
+//
+// Qbox is distributed under the terms of the GNU General Public License
+// as published by the Free Software Foundation, either version 2 of
+// the License, or (at your option) any later version.
+// See the file COPYING in the root directory of this distribution
+// or <http://www.gnu.org/licenses/>.
+//
+////////////////////////////////////////////////////////////////////////////////
+//
+// qmesh_select.h
+//
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef QMESH_SELECT_H
+#define QMESH_SELECT_H
+#include "D3vector.h"
+#include <vector>
+// select the pairs of kpoints (ki,kj) and (ki,-kj) for which q = ki - kj
+// (resp. ki + kj) is on the q-point mesh nq (kpoints in units of b0,b1,b2)
+// nq = (0,0,0): all pairs are selected
+// use_q1[i][j] (resp. use_q2) is non-zero if the pair (ki,kj) (resp.
+// (ki,-kj)) is selected, qfac[i] renormalizes the weights of kpoints j
+// return value: 0: success
+//   1: the kpoints are not on a mesh whose size is a multiple of nq
+//   2: the pairs selected for different kpoints have different weights
+int qmesh_select(const std::vector<D3vector>& kpoint,
+  const std::vector<double>& weight, const int nq[3],
+  std::vector<std::vector<int> >& use_q1,
+  std::vector<std::vector<int> >& use_q2, std::vector<double>& qfac);
+#endif
@@ -21,3 +21,8 @@ void spline(int n, double *x, double *y, double yp_left, double yp_right,
 void splint (int n, double *xa, double *ya, double *y2a, double x, double *y);
 void splintd (int n, double *xa, double *ya, double *y2a,
               double x, double *y, double *dy);
+// interpolation on a uniform grid xa[i] = i * h
+void splint_uniform (int n, double h, const double *ya, const double *y2a,
+                     double x, double *y);
+void splintd_uniform (int n, double h, const double *ya, const double *y2a,
+                      double x, double *y, double *dy);
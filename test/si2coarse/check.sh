@@ -0,0 +1,20 @@
+#!/bin/sh
+# compare the total energy and forces of the FINE and COARSE runs
+# use: check.sh fine.r coarse.r etol ftol
+etot() { grep '<etotal>' $1 | tail -1 | awk '{print $2}'; }
+forces() { grep '<force>' $1 | tail -2 | awk '{print $2, $3, $4}'; }
+e1=`etot $1`
+e2=`etot $2`
+[ -n "$e1" ] && [ -n "$e2" ] || exit 1
+f1=`forces $1 | tr "\n" " "`
+f2=`forces $2 | tr "\n" " "`
+echo "etotal: $e1 $e2"
+echo "forces: $1: $f1"
+echo "forces: $2: $f2"
+echo "$f1 $f2" | awk -v e1=$e1 -v e2=$e2 -v etol=$3 -v ftol=$4 \
+  '{ if ( NF != 12 ) exit 1;
+     de = e1-e2; if (de<0) de=-de;
+     df = 0; for ( i = 1; i <= 6; i++ )
+       { d = $i-$(i+6); if (d<0) d=-d; if (d>df) df=d; }
+     print "etotal difference:", de, "max force difference:", df;
+     exit !(de < etol && df < ftol) }'
@@ -0,0 +1,18 @@
+#!/bin/sh
+# compare a run started with init_wf atomic with a run started with
+# randomize_wf: same total energy, fewer scf iterations, and a lowest
+# init_wf eigenvalue within 0.05 Ha of the converged lowest eigenvalue
+# use: check.sh atomic.r random.r
+etot() { grep '<etotal>' $1 | tail -1 | awk '{print $2}'; }
+n1=`grep -c '<etotal_int>' $1`
+n2=`grep -c '<etotal_int>' $2`
+e1=`etot $1`
+e2=`etot $2`
+# init_wf eigenvalue (Ha), converged eigenvalue (eV)
+eig0=`grep 'init_wf:' $1 | awk '{print $NF}'`
+eig1=`grep -A1 '<eigenvalues' $1 | tail -1 | awk '{print $1}'`
+echo "$1: etotal=$e1 nscf=$n1 eig0=$eig0 eig=$eig1 eV  $2: etotal=$e2 nscf=$n2"
+[ -n "$e1" ] && [ -n "$e2" ] && [ -n "$eig0" ] && [ -n "$eig1" ] || exit 1
+awk -v e1=$e1 -v e2=$e2 -v n1=$n1 -v n2=$n2 -v x0=$eig0 -v x1=$eig1 \
+  'BEGIN { d=e1-e2; if (d<0) d=-d; dx=x0-x1/27.2116; if (dx<0) dx=-dx;
+           exit !(d < 1.e-6 && n1 < n2 && dx < 0.05) }'
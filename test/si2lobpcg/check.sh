@@ -0,0 +1,12 @@
+#!/bin/sh
+# compare the total energy of a LOBPCG run with that of a reference run
+# and check that the LOBPCG scf converged before the iteration limit
+# use: check.sh lobpcg.r ref.r maxscf
+etot() { grep '<etotal>' $1 | tail -1 | awk '{print $2}'; }
+nscf=`grep -c '<etotal_int>' $1`
+e1=`etot $1`
+e2=`etot $2`
+echo "$1: etotal=$e1 nscf=$nscf  $2: etotal=$e2"
+[ -n "$e1" ] && [ -n "$e2" ] || exit 1
+awk -v e1=$e1 -v e2=$e2 -v n=$nscf -v nmax=$3 \
+  'BEGIN { d=e1-e2; if (d<0) d=-d; exit !(d < 1.e-6 && n < nmax) }'
@@ -0,0 +1,13 @@
+# Si2 ground state with the PSDA wavefunction stepper
+set cell 5.13 5.13 0 0 5.13 5.13 5.13 0 5.13
+species silicon Si_VBC_LDA-1.0.xml
+ atom Si1 silicon 1.2825 1.2825 1.2825
+ atom Si2 silicon -1.2825 -1.2825 -1.2825
+kpoint delete 0 0 0
+kpoint add 0.25 0.25 0.25 1.0
+set ecut 12
+set nempty 4
+set scf_tol 1.e-8
+set wf_dyn PSDA
+randomize_wf
+run 0 60
@@ -0,0 +1,10 @@
+#!/bin/sh
+# compare the final value of an xml tag in two runs
+# use: check.sh tag run1.r run2.r tol
+val() { grep "<$1>" $2 | tail -1 | awk '{print $2}'; }
+v1=`val $1 $2`
+v2=`val $1 $3`
+echo "$1: $2: $v1 $3: $v2 tol: $4"
+[ -n "$v1" ] && [ -n "$v2" ] || exit 1
+awk -v v1=$v1 -v v2=$v2 -v tol=$4 \
+  'BEGIN { d=v1-v2; if (d<0) d=-d; exit !(d < tol) }'
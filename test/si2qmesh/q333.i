@@ -0,0 +1,21 @@
+# Si2 PBE0 on a 2x2x2 kpoint mesh, exchange q-point mesh 3x3x3
+set cell 5.13 5.13 0 0 5.13 5.13 5.13 0 5.13
+species silicon Si_VBC_LDA-1.0.xml
+ atom Si1 silicon 1.2825 1.2825 1.2825
+ atom Si2 silicon -1.2825 -1.2825 -1.2825
+kpoint delete 0 0 0
+kpoint add 0.0 0.0 0.0 0.125
+kpoint add 0.5 0.0 0.0 0.125
+kpoint add 0.0 0.5 0.0 0.125
+kpoint add 0.0 0.0 0.5 0.125
+kpoint add 0.5 0.5 0.0 0.125
+kpoint add 0.0 0.5 0.5 0.125
+kpoint add 0.5 0.0 0.5 0.125
+kpoint add 0.5 0.5 0.5 0.125
+set ecut 10
+set xc PBE0
+set qmeshHF 3 3 3
+set scf_tol 1.e-8
+set wf_dyn PSDA
+randomize_wf
+run 0 60
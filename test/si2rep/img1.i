@@ -0,0 +1,10 @@
+# Si2 ground state, replica 1 of qb -nrep 2 img%d.i
+set cell 10.26 0 0  0 10.26 0  0 0 10.26
+species silicon Si_VBC_LDA-1.0.xml
+atom Si1 silicon 0.0 0.0 0.0
+atom Si2 silicon 4.1 0.0 0.0
+set ecut 8
+set wf_dyn PSDA
+set ecutprec 4
+randomize_wf
+run 0 20
@@ -0,0 +1,12 @@
+# Si2 ground state, two replicas reading the same script
+# qb -nrep 2 shared.i writes shared.0.r and shared.1.r
+set cell 10.26 0 0  0 10.26 0  0 0 10.26
+species silicon Si_VBC_LDA-1.0.xml
+atom Si1 silicon 0.0 0.0 0.0
+atom Si2 silicon 4.$replica 0.0 0.0
+set ecut 8
+set wf_dyn PSDA
+set ecutprec 4
+randomize_wf
+run 0 20
+save si2_$replica.xml